@@ -208,6 +208,9 @@
 /* Define to the version of this package. */
 #define PACKAGE_VERSION "2.2.1"
 
+/* store particle locations in single precision */
+/* #undef PUFF_SINGLE_PRECISION */
+
 /* make additional statistical information */
 /* #undef PUFF_STATISTICS */
 
@@ -1,6 +1,7 @@
 #ifndef ASH_H_
 #define ASH_H_
 
+#include <cstdio> // FILE
 #include <string>
 #include <vector> // std::vector<>
 #include "particle.h"
@@ -16,20 +17,24 @@ extern const int ASH_OK;
 class Ash {
     long     ashN;
     long     ashNpart;
-    long int numGrounded, numOutOfBounds;
+    long int numGrounded, numOutOfBounds, numMerged;
     Particle *particle;
     std::vector<Particle> recParticle; // record of particles
     std::vector<long> recTime; // record of times
+    std::vector<double> gridX, gridY; // projection grid x/y, see restoreGrid()
     long     recAshN;  // number of particles in the complete record
     long     clockTime;
     long     origTime;
     char     origName[120];
     double   minlat, minlon, minhgt, maxlat, maxlon, maxhgt;
     enum {ASH_SORT_YES, ASH_SORT_NO, ASH_SORT_NEVER} sorting_protocol;
-		enum {ASH_SORT_T, ASH_SORT_X, ASH_SORT_Y, ASH_SORT_Z} sorting_variable;
+		enum {ASH_SORT_T, ASH_SORT_X, ASH_SORT_Y, ASH_SORT_Z, ASH_SORT_MORTON} sorting_variable;
 
 //    float *abs_air_conc_avg, *rel_air_conc_avg, *abs_fo_conc_avg, *rel_fo_conc_avg;
    CCloud cc;
+    // running average of -repeat runs, see averageGriddedData()
+    bool     avgAllocated;
+    int      avgWeight;
     
 public:
 #ifdef PUFF_STATISTICS
@@ -42,9 +47,16 @@ public:
     ~Ash();
 
     int create(long n);
+    void release();
 
     void write(const char *file);
     int read(char *file);
+
+    // CHECKPOINTS: the complete state of the particles, records and 
+    // averages.  readState() returns the end of the state in 'p', or NULL
+    // if the state is truncated or does not fit this ash.
+    int writeState(FILE *f);
+    const char *readState(const char *p, const char *end);
     
     void clearStash();
     void findLimits();
@@ -53,6 +65,12 @@ public:
     void horiz_spread(float width, float height, float bottom);
     void init_site(float lon, float lat, char *name);
     void init_site_custom(int multE=0, maparam* proj_grid=NULL);  
+    // convert the locations between a projection grid and lon/lat, each
+    // particle on its own so the order does not matter.  With 'keep' the
+    // grid x/y are kept for restoreGrid() to put back, by index.
+    void gridToLonLat(maparam *proj_grid, bool keep=false);
+    void lonLatToGrid(maparam *proj_grid);
+    void restoreGrid();
     void init_age(long erupt_time, long lengthSecs);
     int  init_size(double logMean, double logSdev, char* phiDist);
     void init_linear_column(float height, float bottom=0.0);
@@ -61,7 +79,10 @@ public:
     void initialize();
     int isAshFile(char *name);
     int outOfBounds(int outIdx);
-    void quicksort();
+    long adapt(int target);
+    void sort();
+    // sort for the next write() if -sorted=yes
+    void sortOutput();
     void setSortingProtocol(char *arg);
     void writeGriddedData(std::string eDate, bool last);
     void writeGriddedFile(std::string filename);
@@ -72,6 +93,9 @@ public:
     
     // RETURNS:
     int n() { return ashN; }
+    long nGrounded() const { return numGrounded; }
+    long nOutOfBounds() const { return numOutOfBounds; }
+    long nMerged() const { return numMerged; }
     
     // shortcut notation for particle location
     Particle *r;
@@ -93,6 +117,10 @@ public:
     bool isGrounded(long i) const { return particle[i].grounded;}
     double fallVelocity(int idx) ;
     bool particleExists(long i) const  { return particle[i].exists; }
+    // a slot freed by adapt(), waiting to be reused by a split
+    bool isMerged(long i) const { 
+      return (!particle[i].exists && !particle[i].grounded && 
+              particle[i].size == 0 && particle[i].mass_fraction == 0); }
 		void copyRotatedGrid(struct GridRotation *r);
 		bool isRotatedGrid();
 
@@ -111,6 +139,8 @@ public:
     
 private:
     int allocate();
+    int openAshFile(char *file, int &cdfid);
+    int readCdf(int cdfid, const char *file);
     void averageGriddedData(float *abs_air_conc,
                             float *rel_air_conc, 
 														float *abs_air_size,
@@ -121,6 +151,11 @@ private:
 	void rotateGrid(double *loc, float val, ID l);
 	void rotateGridPoint(double *loc, float val, ID l);
 
+    unsigned long long sortableKey(double val);
+    void mortonKeys(std::vector<unsigned long long> &key);
+    void radixsort(std::vector<unsigned long long> &key, std::vector<long> &idx);
+    void reorder(std::vector<long> &idx);
+
 };
 
 bool cmpX(Particle a, Particle b);
@@ -24,9 +24,10 @@
 
 struct Argument {
   bool age, airborne, fallout, feet, hdr, lat, lon, stats, showHeight;
-  bool showParams, showSize;
+  bool series, showParams, showSize;
   char *height, *infile, *range, *size; 
-  int precision, width;
+  char **infiles;
+  int jobs, nfiles, precision, width;
   };
     
 void parse_options(int argc, char **argv);
@@ -34,6 +35,6 @@ void set_defaults(struct Argument *argument);
 void show_help();
 void ashdump_usage();
 
-enum keyWords { ASHDUMP_AGE, AIRBORNE, INFILE, FALLOUT, FEET, HDR, HEIGHT, HELP, ASHDUMP_LAT, ASHDUMP_LON, PRECISION, RANGE, SHOWPARAMS, SIZE, STATS, ASHDUMP_SZ, USAGE, VARIABLE_LIST, VERSION_ASHDUMP, WIDTH, ASHDUMP_Z };
+enum keyWords { ASHDUMP_AGE, AIRBORNE, INFILE, FALLOUT, FEET, HDR, HEIGHT, HELP, JOBS, ASHDUMP_LAT, ASHDUMP_LON, PRECISION, RANGE, SERIES, SHOWPARAMS, SIZE, STATS, ASHDUMP_SZ, USAGE, VARIABLE_LIST, VERSION_ASHDUMP, WIDTH, ASHDUMP_Z };
 
 #endif /* ASHDUMP_OPTIONS_H */
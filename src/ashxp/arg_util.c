@@ -50,6 +50,7 @@ void ashxp_set_defaults(struct Ash *ash) {
   arguments.grayscale = 0;
   arguments.hgtmax = -1.0;
   arguments.include_out_of_bounds = 0;
+  arguments.jobs = 1;
 	arguments.labelv = (char**)calloc(100,sizeof(char*));
 	arguments.labelc = 0;
 	arguments.labelfile = 0x0;
@@ -104,6 +105,7 @@ void ashxp_parse_options(int argc, char** argv)
     {"height-range",required_argument,0,'r'},/*filter this height range*/
     {"help",no_argument,0,'?'},/* show help */
     {"include-out-of-bounds",no_argument,0,129},/*plot out-of-bounds ash*/
+    {"jobs",required_argument,0,'j'},/*frames drawn at the same time*/
     {"magnify",required_argument,0,'m'},/*magnify image*/
     {"max-height",required_argument,0,'h'},/*maximum height for color-coding*/
 		{"label",required_argument,0,'L'},/*label text on background*/
@@ -137,7 +139,7 @@ void ashxp_parse_options(int argc, char** argv)
     int opt_idx=0; /* Index of current long option into opt_lng array */
   /* Parse our arguments; every option seen by parse_opt will
      be reflected in arguments. */
-  opt_sng = "ab:B:c:gG:F:fh:l:m:o:P:p:qr:Rstvwx:XV";
+  opt_sng = "ab:B:c:gG:F:fh:j:l:m:o:P:p:qr:Rstvwx:XV";
   while((opt = getopt_long(argc,argv,opt_sng,opt_lng,&opt_idx)) != EOF){
   switch (opt)
     {
@@ -227,6 +229,13 @@ void ashxp_parse_options(int argc, char** argv)
       break;
     case 'h':
       arguments.hgtmax = (float)atof(optarg);
+      break;
+    case 'j':
+      arguments.jobs = atoi(optarg);
+      if (arguments.jobs < 1) {
+        printf("ERROR: invalid argument for --jobs option: \"%s\"\n",optarg);
+        exit(EXIT_FAILURE);
+        }
       break;
 		case 'L':
 			arguments.labelv[arguments.labelc] = strdup(optarg);
@@ -421,6 +430,7 @@ void show_help() {
   puts("--gridlines=DG:INTxDG:INT[COLOR]       as above, and INT pixels wide");
   puts("--hgt-range=H1/H2     -r H1/H2         (meters)");
   puts("--include-out-of-bounds                plot out-of-bounds ash");
+  puts("--jobs=INT            -j INT           draw INT frames at the same time");
   puts("--latlon=y1/y2/x1/x1  -l y1/y2/x1/x1   set bounding box");
 	puts("--label=X,Y,STRING     L X,Y,STRING    put STRING at (X,Y)");    
 	puts("--label-file=FILE                      labels are in file FILE");
@@ -4,6 +4,9 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <sys/types.h>
+#include <sys/wait.h> /* wait() */
+#include <unistd.h>   /* fork() */
 #ifdef HAVE_GETOPT_H
 #include <getopt.h>
 #else
@@ -19,6 +22,8 @@ int main (int argc, char **argv){
   char *file;  /* input filename */
   struct Ash ash;
   struct bg_img bg;
+  pid_t pid;
+  int running = 0, failed = 0, status;
 
       
   /* set defaults before parsing command line */
@@ -41,21 +46,45 @@ int main (int argc, char **argv){
   /* clip out the portion of bgimage we need */
   clip_bg(&bg);
   
-  /* loop through all file remaining on the command line */
+  /* loop through all file remaining on the command line.  With --jobs, 
+   * each frame is read, drawn and written by a forked child; the clipped
+   * and projected background above is shared by all of them.
+   */
   while (argv[optind] != NULL ) {
     /* make a working copy of tbe file named to process */
     file = (char*)calloc(strlen(argv[optind])+1,sizeof(char));
     strcpy(file, argv[optind]);
     
-    (void)read_ash(&ash, file);
-    
     if (!arguments.output_file ) 
     {
       /* allocate space for output file, allowing for a new suffix */
       arguments.output_file = (char*)calloc(strlen(file)+5,sizeof(char));
       strcpy(arguments.output_file, create_ofile(file) );
     }   
-    frame(&ash, &bg);
+
+    pid = -1;
+    if (arguments.jobs > 1) {
+      /* wait for a free slot */
+      while (running >= arguments.jobs && wait(&status) > 0) {
+        running--;
+        if (!WIFEXITED(status) || WEXITSTATUS(status) != 0) failed++;
+        }
+      fflush(stdout);
+      pid = fork();
+      }
+    if (pid > 0) {
+      running++;
+      }
+    else {
+      /* the child, or this process if not forking.  create_ofile() has
+       * changed 'file', so read the name from the command line */
+      (void)read_ash(&ash, argv[optind]);
+      frame(&ash, &bg);
+      if (pid == 0) {
+        fflush(stdout);
+        _exit(0);
+        }
+      }
     
     /* advance the counter to process the next file */
     optind++;
@@ -65,9 +94,18 @@ int main (int argc, char **argv){
     arguments.output_file = 0x0;
     }
     
+  /* wait for the remaining frames */
+  while (running > 0 && wait(&status) > 0) {
+    running--;
+    if (!WIFEXITED(status) || WEXITSTATUS(status) != 0) failed++;
+    }
+  if (failed > 0) {
+    fprintf(stderr, "ERROR: %d frame(s) failed\n", failed);
+    }
+
   /* generate report if requested */
   if (arguments.report) puts(arguments.rpt_txt);
   free(bg.rgb);  
-  return 0;
+  return (failed > 0) ? EXIT_FAILURE : 0;
   
   }
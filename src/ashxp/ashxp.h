@@ -38,7 +38,7 @@ struct bg_img {
 
 struct arguments {
   int airborne, border, fallout, fontsize, grayscale;
-  int include_out_of_bounds, labelc, magnify, minsize, mpeg, nobg;
+  int include_out_of_bounds, jobs, labelc, magnify, minsize, mpeg, nobg;
   int pixels, print_datetime_stamp, quiet, report, sorted, temp, verbose, whole;
   int xgridline_pixels, ygridline_pixels;
   char *bgfile, *color, *colorbar_size, *fontfile, *labelfile, *llstr, *output_file, *range, *rpt_txt;
@@ -3,9 +3,12 @@
 
 #include <string> // string
 #include <ctime> // time_t
+#include <vector>
 #include "Grid.h"
 #include "particle.h"
 
+class PuffRC;
+
 class Atmosphere {
 
 private:
@@ -16,6 +19,13 @@ private:
   Grid T;
 	Grid Kh;
   
+  // fall velocity table, see tabulateFall()
+  std::vector<float> fallTable;  // [time][height][size]
+  std::vector<double> fallSize;  // log of particle radius at each node
+  std::vector<float> fallTime;   // hours, like the wind records
+  double fallZ0, fallDZ;         // first height and spacing in meters
+  int fallNz;
+  
   // paths and filenames from where the data was read
   std::string filenameU;
   std::string filenameV;
@@ -23,6 +33,16 @@ private:
   
   time_t reftime_t;
 
+  // nested domains, coarse to fine, see addNest()
+  std::vector<Atmosphere*> nests;
+  bool isNest;
+  float nestShift;  // hours added to the outer domain's wind time
+  // the region to read with -regionalWinds=auto, see autoWindBox()
+  bool hasWindBox;
+  float windBox[4];  // west, east, south, north
+
+  enum Field {FIELD_U, FIELD_V, FIELD_W, FIELD_T, FIELD_P, FIELD_KH};
+
 public:
   
 	double *center_lon, *center_lat;
@@ -32,6 +52,10 @@ public:
  
  int init(double *lon, double *lat);
  
+ // load another rcfile model as a finer domain inside this one
+ int addNest(const char *model);
+ int nNests() { return nests.size(); }
+ 
  // these functions return scalar values for atmospheric conditions at a
  // given x,y,z point given by Particle's location
  float fallVelocity(float time, Particle *p);
@@ -42,11 +66,22 @@ public:
  float pressure(float time, Particle *p);
  float diffuseKh(float time, Particle *p);
  
+ // blend the wind records at 'time' into slabs for this time step, 
+ // optionally only over the x,y box; see Grid::blend()
+ void blend(float time, float xlo=1, float xhi=-1, float ylo=1, float yhi=-1);
+ 
+ // precompute fallVelocity() for particles of these radii
+ void tabulateFall(const std::vector<double> &sizes);
+ 
  // these return the full path and filename for where the data was read from
  const std::string *fileU() { return &filenameU;};
  const std::string *fileV() { return &filenameV;};
  const std::string *fileW() { return &filenameW;};
  
+ // the files U and V would be read from, without reading them
+ void windFiles(PuffRC &rc, std::vector<std::string> &u, 
+                std::vector<std::string> &v);
+ 
  // return a true/false whether this x,y point is within the atmospheric data
  bool containsXYPoint(float x, float y);
  int containsZPoint(float z);
@@ -62,11 +97,35 @@ public:
  float zMin() { return U.min(LEVEL);}
  float zMax() { return U.max(LEVEL);}
  
+ // mean spacing of the wind grid, in grid units (meters vertically)
+ float xSpacing() { return spacing(LON); }
+ float ySpacing() { return spacing(LAT); }
+ float zSpacing() { return spacing(LEVEL); }
+ // the same for the finest domain containing 'p'
+ float xSpacing(Particle *p) { return domain(p)->spacing(LON); }
+ float ySpacing(Particle *p) { return domain(p)->spacing(LAT); }
+ float zSpacing(Particle *p) { return domain(p)->spacing(LEVEL); }
+ 
  time_t reference_time();
  
 private:
-  int make_winds();
-  int read_uni(Grid &grid, std::string *filename);
+  float spacing(ID dimid) { 
+    return (U.n(dimid) > 1 ? (U.max(dimid)-U.min(dimid))/(U.n(dimid)-1) : 0);
+  }
+  double fallLaw(double size, double z, double temp, double pres);
+  bool lookupFall(float time, Particle *p, float &v);
+  Atmosphere *domain(Particle *p);
+  float local(Field f, float time, Particle *p);
+  float nestWeight(Particle *p, float &x);
+  float sample(Field f, float time, Particle *p, int top);
+  int make_winds(PuffRC &rc);
+  std::vector<std::string> dataFiles(PuffRC &rc, char *var, 
+                                     const char *fileArg, bool usePath,
+                                     const std::vector<std::string> *cycles = NULL);
+  int read_uni(Grid &grid, const std::vector<std::string> &files);
+  int read_one(Grid &grid, const std::string &file, unsigned int minRecords);
+  int autoWindBox(const std::vector<std::string> &Ufiles,
+                  const std::vector<std::string> &Vfiles);
   int wind_create_W(Grid &U, Grid &V, Grid &W, Grid &Kh);
 	void checkRotatedGrid(const char *file);
 	void checkRotatedGridError();
@@ -0,0 +1,80 @@
+/****************************************************************************
+    puff - a volcanic ash tracking model
+    Copyright (C) 2001-2003 Rorik Peterson <rorik@gi.alaska.edu>
+
+    This program is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program; if not, write to the Free Software
+    Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+****************************************************************************/
+
+#ifndef CHECKPOINT_H_
+#define CHECKPOINT_H_
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include <string>
+#include "ash.h"
+#include "ran_utils.h"
+
+// A checkpoint holds everything needed to continue a run exactly where it
+// was written (-checkpointHours, -resume): this header, then the ash
+// state from Ash::writeState().  It is written in the machine's own 
+// format and is only read back by the same build of puff.
+struct CheckpointHeader {
+  char     magic[8];       // "PUFFCKPT"
+  int      version;
+  int      realSize;       // sizeof(particle_real)
+  int      particleSize;   // sizeof(Particle)
+  int      statistics;     // built with PUFF_STATISTICS
+  long     eruptDate;      // must match the resumed run
+  long     dtMins;
+  long     clock;          // time of the next step
+  long     printOut;       // time since the last ash file
+  long     checkpointOut;  // time since the last checkpoint
+  int      repeatCount;
+  int      iseed;
+  double   writeOrigin[2]; // kept by write_ash() between calls
+  RanState ran;
+  };
+
+// fill in the parts of 'head' that describe this build
+void initCheckpointHeader(CheckpointHeader &head);
+
+// write a checkpoint from a forked copy of this process, so the run 
+// continues while it is written.  The file is renamed into place when it
+// is complete.  Waits for the previous checkpoint first.
+int writeCheckpoint(const std::string &file, const CheckpointHeader &head,
+                    Ash &ash);
+
+// wait for a checkpoint being written
+int waitCheckpoint();
+
+// a checkpoint mapped into memory for -resume
+class Checkpoint {
+  const char *data;
+  size_t      length;
+  CheckpointHeader head;
+public:
+  Checkpoint() : data(NULL), length(0) {}
+  ~Checkpoint() { close(); }
+  // map 'file' and check that it belongs to a run like this one
+  int open(const char *file, long eruptDate, long dtMins);
+  void close();
+  const CheckpointHeader &header() const { return head; }
+  // restore the ash and random number state
+  int restore(Ash &ash);
+  };
+
+#endif
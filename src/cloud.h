@@ -31,9 +31,12 @@ class Cloud {
   int inside, nElev, nSegments;  
   std::vector<Particle> elevPoint;
   double *lonlatValues, mean, sdev;
-  float testX, testY, elevEqnA, elevEqnB, elevEqnC;
-  float lengthScale;
+  float elevEqnA, elevEqnB, elevEqnC;
   std::vector<Segment> segment;
+  // segments binned by longitude so 'define' only tests the few that span x
+  std::vector< std::vector<int> > column;
+  int nColumns;
+  double xMin, xMax, yMin, yMax, columnWidth;
   char *restartFile;
 
   void build();
@@ -42,9 +45,8 @@ class Cloud {
   int   inCloud(double, double);  
   void  makeSlopes();
   int   define(double, double);
-  float distance(Particle);
-  void  setLengthScale();
-  void  sortElevations();
+  double distance(const Particle&, double, double);
+  void  makeColumns();
   bool  validRegion();
   
 public:
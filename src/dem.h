@@ -3,6 +3,8 @@
 
 #define DEM_ERROR 1
 #define DEM_OK 0
+// higher than any terrain (meters), elevation lookups are not needed above
+#define DEM_MAX_ELEVATION 8850.0
 
 #ifdef HAVE_CMAPF_H
 #include "cmapf.h"
@@ -21,6 +21,7 @@
 #include <cstdlib>
 #include <string>
 #include <cstring>
+#include <vector>
 
 #ifdef HAVE_NETCDFCPP_H
 #include <netcdfcpp.h>
@@ -38,6 +39,8 @@ extern const int FG_ERROR;
 extern const int FG_OK;
 
 #define FGMAXCHAR 65
+// compact value of fill values, see Grid::compact()
+#define FG_PACKED_FILL (-32768)
 
 #ifdef BUG_GMTIME
 #define gmtime localtime
@@ -51,9 +54,11 @@ enum IO_ENUM { USEEXTENSION, FLTGRID, BINARY, FLTARRAY, ASCIITEXT, CDF };
 
 enum INTERP_ENUM { FG_VSPLINE, FG_NNINT };
 
+// sizes and offsets are size_t since a 4D grid may hold more than 2^32 
+// values, though each dimension is well below that
 struct fgDataStruct {
     float              *val;
-    unsigned int       size;
+    size_t             size;
     char               name[FGMAXCHAR];
     char               units[FGMAXCHAR];
     float              range[2];
@@ -77,14 +82,26 @@ protected:
 	float min_value[5], max_value[5];
 
     int uniShiftWest;  // imported from uniGrid.h
+    unsigned int fgStride;  // keep every fgStride'th LAT and LON when reading
     
     // Display Variables:
     int		    fgWidth;
     int		    fgPrecision;
     int		    fgLeftAdjust;
     char	    fgSpace[7];
+
+    // Time Slab Variables, see blend():
+    std::vector<float> fgSlab;
+    bool            fgSlabValid;
+    float           fgSlabTime;
+    int             fgSlabIlo;
+    int             fgSlabK0, fgSlabK1, fgSlabL0, fgSlabL1;
     enum {UNKNOWN, REGIONAL, GLOBAL} coverage;
 
+    // Compact Storage Variables, see compact():
+    std::vector<short> fgPacked;
+    std::vector<float> fgPackScale, fgPackOffset;  // per FRTIME and LEVEL
+
     
 public:
     ~Grid();
@@ -124,7 +141,7 @@ public:
     fgDataStruct & operator[](ID dimid) { return fgData[dimid]; }
     bool empty() { return (fgData[VAR].size == 0); }
     int ndims() { return fgNdims; }
-    int n(ID dimid=VAR) { return fgData[dimid].size; }
+    size_t n(ID dimid=VAR) { return fgData[dimid].size; }
     char *name(ID index=VAR) {return fgData[index].name;}
     char *title() {return fgTitle;}
     char *reftime() {return fgReftime;}
@@ -136,7 +153,7 @@ public:
     bool isProjectionGrid();
     
     // OPERATOR():
-    float & operator()(unsigned int i) { 
+    float & operator()(size_t i) { 
         ck_ndims(1); ck_index(FRTIME, i);
 	return fgData[VAR].val[i];
     }
@@ -151,30 +168,41 @@ public:
      float & operator()(unsigned int i, unsigned int j, unsigned int k, 
  		       unsigned int l) {
 	    ck_ndims(4); ck_index(FRTIME, i); ck_index(LEVEL, j); 
-	    ck_index(LAT, k); ck_index(LON, l);
+	    ck_index(LAT, k); ck_index(LON, l); ck_values();
  	return fgData[VAR].val[offset(i, j, k, l)];
      }
     float & operator()(ID dimid, unsigned int i) {
-	    ck_index(dimid, i);
+	    ck_index(dimid, i); if (dimid == VAR) ck_values();
 	return fgData[dimid].val[i];
     }
     
     // OFFSET:
-    inline unsigned int offset(unsigned int i) { return i; }
-    inline unsigned int offset(unsigned int i, unsigned int j) { 
-	return i*fgData[LEVEL].size + j;
+    inline size_t offset(unsigned int i) { return i; }
+    inline size_t offset(unsigned int i, unsigned int j) { 
+	return size_t(i)*fgData[LEVEL].size + j;
     }
-    inline unsigned int offset(unsigned int i, unsigned int j, unsigned int k) { 
-	return i*fgData[LEVEL].size*fgData[LAT].size + j*fgData[LAT].size + k;
+    inline size_t offset(unsigned int i, unsigned int j, unsigned int k) { 
+	return (size_t(i)*fgData[LEVEL].size + j)*fgData[LAT].size + k;
     }
-    inline unsigned int offset(unsigned int i, unsigned int j, unsigned int k, 
+    inline size_t offset(unsigned int i, unsigned int j, unsigned int k, 
                                unsigned int l) { 
-	return i*fgData[LEVEL].size*fgData[LAT].size*fgData[LON].size +
-	       j*fgData[LAT].size*fgData[LON].size + k*fgData[LON].size + l;
+	return ((size_t(i)*fgData[LEVEL].size + j)*fgData[LAT].size + k)*
+	       fgData[LON].size + l;
     }
     
     
-    // DIMENSION SETS:
+    // 4D value, decoded if compact
+    inline float value(unsigned int i, unsigned int j, unsigned int k,
+                       unsigned int l) {
+	const size_t off = offset(i, j, k, l);
+	if ( fgData[VAR].val ) return fgData[VAR].val[off];
+	const size_t p = size_t(i)*fgData[LEVEL].size + j;
+	const short v = fgPacked[off];
+	return (v == FG_PACKED_FILL ? fgFillValue : 
+	        fgPackOffset[p] + fgPackScale[p]*v);
+    }
+    
+        // DIMENSION SETS:
     int dim_norm(ID dimid, float fmax=1.0);
     int dim_step(ID dimid, float start, float step);
 //    int dim_expand(ID, float start, float end);
@@ -190,11 +218,15 @@ public:
     void set_valid_range(float rlo, float rhi);
     void set_range(ID index, float rlo, float rhi);
     void set_fill_value(float fill) { fgFillValue = fill; }
+    // read_cdf() and read_grib2() keep only every 's'th latitude and
+    // longitude, for a cheap coarse look at the data
+    void set_stride(unsigned int s) { fgStride = (s > 0 ? s : 1); }
+    unsigned int stride() { return fgStride; }
 		void set_minimum(ID idx);
 		void set_maximum(ID idx);
     
     // SPLINE ROUTINES:
-    void patch(ID line1=FRTIME, ID line2=LEVEL, ID line3=LAT, ID line4=LON);
+    float patch(ID line1=FRTIME, ID line2=LEVEL, ID line3=LAT, ID line4=LON);
     void patch_line(ID lineid);
     
     float vspline(float xx);
@@ -207,6 +239,22 @@ public:
     float nnint(float xx, float yy, float zz);
     float nnint(float xx, float yy, float zz, float tt);
 
+    // TIME SLAB:
+    // blend the two records around time 'xx' once so that 4D nnint() calls
+    // at that time interpolate a single 3D slab.  The optional LAT and LON
+    // box limits the blend to that region.
+    void blend(float xx, float zlo=1, float zhi=-1, float tlo=1, float thi=-1);
+    void unblend() { fgSlabValid = false; }
+
+    // COMPACT STORAGE:
+    // keep a 4D object's values as 16-bit integers scaled over each FRTIME
+    // and LEVEL, which halves its memory.  Only nnint(), vspline() and 
+    // blend() read compact values; expand() restores the floats for 
+    // anything else, and a 4D operator() calls it.
+    int compact();
+    void expand();
+    bool compacted() { return !fgPacked.empty(); }
+
     // SNAP TO NEAREST GRID:
     void snap(float x, int &i);
     void snap(float x, float y, int &i, int &j);
@@ -214,7 +262,13 @@ public:
     void snap(float x, float y, float z, float t, 
 	      int &i, int &j, int &k, int &l);
 
-    int read_cdf(const std::string *file, const char* eruptDate, const double runHours);
+    int read_cdf(const std::string *file, const char* eruptDate, 
+                 const double runHours, unsigned int minRecords = 2);
+    // same as read_cdf() for GRIB2 files, see grib2_io.C
+    int read_grib2(const std::string *file, const char* eruptDate, 
+                   const double runHours, unsigned int minRecords = 2);
+    // append the records of another file of the same grid
+    int stitch(Grid &next);
 
   // imported from uniGrid.h
     void set_shift_west(int i=1) { uniShiftWest = i; }
@@ -230,16 +284,26 @@ public:
 protected:
     void allocate(unsigned int nx1=0, unsigned int nx2=0, 
 		  unsigned int nx3=0, unsigned int nx4=0);
+    void set_size(unsigned int nx1=0, unsigned int nx2=0, 
+		  unsigned int nx3=0, unsigned int nx4=0);
     void initialize();
     
         inline void ck_ndims(unsigned int n) { 
 	    if (fgNdims != n ) fg_error_ndims();
 	}
-        inline void ck_index(ID dimid, unsigned int i) {
+        inline void ck_index(ID dimid, size_t i) {
 	    if (i >= fgData[dimid].size) fg_error_index(dimid); 
 	}
+        // a reference needs the float values, so a compact grid is expanded
+        inline void ck_values() {
+	    if (!fgData[VAR].val && compacted()) expand();
+	}
     
     // SPLINE ROUTINES:
+    long bad_mask(std::vector<unsigned char> &bad, 
+                  std::vector<unsigned long> &badList);
+    long patch_line(ID lineid, std::vector<unsigned char> &bad,
+                    std::vector<unsigned long> &badList);
     void spline(float *x, float *y, int n, float yp1, float ypn, float *y2);
     void splint(float *xa, float *ya, float *y2a, int n, float x, float & y);
 
@@ -257,7 +321,10 @@ private:
     int write_cdf(char *file);
     int read_pp(std::string *file);
 
+    void cull_times(const std::string *file, const char *eruptDate, 
+                    const double runHours, unsigned int minRecords);
 		void adjust_dimensions(long int *offsets, int dim_idx);
+		void stride_dimension(long int *sizes, int dim_idx);
 		void make_monotonic();
     void locate(float *xx, int n, float x, int &j);
     void snap_line(float *xx, int n, float x, int &j);
@@ -284,6 +351,11 @@ private:
 char *time2unistr(time_t time);
 int init_grid(char* filename, maparam *proj_grid);
 int init_grid(std::string filename, maparam *proj_grid);
+void ll2xy(maparam *proj_grid, size_t n, const double *lat, 
+           const double *lon, double *x, double *y);
+void xy2ll(maparam *proj_grid, size_t n, const double *x, const double *y, 
+           double *lat, double *lon);
+bool isGrib2(const std::string *file);
 
   // imported from uniGrid.h
 time_t unistr2time(const char *unistr);
@@ -1,13 +1,32 @@
 #ifndef PARTICLE_H_
 #define PARTICLE_H_
 
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+// particle locations, sizes and mass fractions are stored in single 
+// precision when configured --with-single-precision.  Times stay double
+// since a float cannot hold seconds since 1970 to the second.
+#ifdef PUFF_SINGLE_PRECISION
+typedef float particle_real;
+#else
+typedef double particle_real;
+#endif
+
+// a change of location.  It is always double precision so that small
+// increments are summed before being rounded into a Particle.
+struct Displacement {
+    double   x, y, z;
+};
+
 class Particle {
     
 public:
-    double   x, y, z;  // 3-dimensional location
-    double   size;  // radius in meters
+    particle_real   x, y, z;  // 3-dimensional location
+    particle_real   size;  // radius in meters
     double   startTime;
-    double   mass_fraction;
+    particle_real   mass_fraction;
     bool     grounded; // is ash on the ground?
     bool     exists;   // has ash left the boundary?
     int      order;    // sorted order
@@ -19,6 +38,7 @@ public:
     Particle & operator=(const Particle &pnt);
     Particle & operator+(Particle &pnt); 
     Particle & operator-(Particle &pnt); 
+    Particle & operator+=(const Displacement &d);
     
 
 };
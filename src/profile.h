@@ -0,0 +1,95 @@
+/****************************************************************************
+    puff - a volcanic ash tracking model
+    Copyright (C) 2001-2003 Rorik Peterson <rorik@gi.alaska.edu>
+
+    This program is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program; if not, write to the Free Software
+    Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+****************************************************************************/
+
+#ifndef PROFILE_H_
+#define PROFILE_H_
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include <ctime>
+#include <vector>
+
+// stages of a run that are timed when profiling is turned on.  Stages may
+// nest, i.e. PROF_STEP contains PROF_ADVECT which contains PROF_INTERP.
+enum ProfileStage { PROF_READ, PROF_PATCH, PROF_PTOH, PROF_CREATE_W, 
+                    PROF_INIT_ASH, PROF_ADVECT, PROF_WRITE_ASH, PROF_STASH,
+		    PROF_GRIDDED, PROF_PLANES, PROF_ATMOSPHERE, PROF_STEP,
+		    PROF_INTERP, PROF_DEM, PROF_RNG, PROF_SLAB, PROF_CHECKPOINT,
+		    PROF_ADAPT, PROF_NSTAGES };
+
+// running totals kept alongside the timers
+enum ProfileCounter { PCOUNT_INTERP, PCOUNT_BYTES, PCOUNT_SUBSTEPS, 
+                      PCOUNT_NCOUNTERS };
+
+// one line of the per-step timeline
+struct ProfileStep {
+  time_t clock;
+  double seconds, interp, dem, rng;
+  long   active, grounded, outOfBounds;
+};
+
+// Accumulates wall-clock time spent in each stage.  When not enabled, 
+// start() and stop() return immediately, so the calls can stay in place.
+class Profile {
+    bool   active;
+    double runStart;
+    double started[PROF_NSTAGES];
+    double elapsed[PROF_NSTAGES];
+    long   calls[PROF_NSTAGES];
+    long   particleSteps;
+    long   counter[PCOUNT_NCOUNTERS];
+    double stepMark[PROF_NSTAGES];  // 'elapsed' at the end of the last step
+    std::vector<ProfileStep> timeline;
+
+public:
+    Profile();
+
+    void enable();
+    bool enabled() const { return active; }
+    void start(ProfileStage s) { if (active) started[s] = now(); }
+    void stop(ProfileStage s) { 
+      if (active) { elapsed[s] += now() - started[s]; calls[s]++; } 
+      }
+    void addParticleSteps(long n) { particleSteps += n; }
+    void count(ProfileCounter c, long n = 1) { if (active) counter[c] += n; }
+    void addFileBytes(const char *filename);
+    void endStep(time_t clock, long active, long grounded, long outOfBounds);
+
+    int writeBenchmark(const char *filename);
+    int writeTimeline(const char *filename);
+    void summary();
+
+    static double now();
+    static long peakRSS();
+    static const char *stageName(ProfileStage s);
+};
+
+extern Profile profile;
+
+// times a stage for the lifetime of the object
+class ProfileScope {
+    ProfileStage stage;
+public:
+    ProfileScope(ProfileStage s) : stage(s) { profile.start(stage); }
+    ~ProfileScope() { profile.stop(stage); }
+};
+
+#endif // PROFILE_H_
@@ -30,12 +30,17 @@
 #include <vector>
 
 enum Sedimentation {FALL_STOKES, FALL_REYNOLDS, FALL_CONSTANT};
+enum Integrator {INTEGRATE_EULER, INTEGRATE_RK2, INTEGRATE_RK4};
+enum TimeSlab {SLAB_NONE, SLAB_FULL, SLAB_BOX};
+enum GridKernel {KERNEL_NONE, KERNEL_GAUSSIAN, KERNEL_EPANECHNIKOV};
 
 struct Argument {
   std::string command_line,
 							opath,
   						saveWfilename;
   char *argFile, 
+       *benchmarkFile,
+       *checkpointFile,
        *dem, 
        *eruptDate, 
        *fileT, 
@@ -46,13 +51,18 @@ struct Argument {
        *gridSize, 
        *logFile, 
        *model, 
+       *nestModels,
       // *opath, 
        *path, 
        *phiDist,
        *plumeShape,
+       *profileFile,
        *rcfile, 
        *restartFile, 
+       *resumeFile,
+       *serveSocket,
        *sorted, 
+       *sourcesFile,
        *varU, 
        *varV, 
        *varZ, 
@@ -60,6 +70,8 @@ struct Argument {
        *volcFile;
   double ashLogMean, 
          ashLogSdev, 
+	 cfl,
+	 checkpointHours,
 	 diffuseH, 
 	 diffuseZ, 
 	 drag,
@@ -75,14 +87,20 @@ struct Argument {
 	 saveHours, 
 	 volcLon, 
 	 volcLat;
-  int dem_lvl, 
+  int adaptive,
+      dem_lvl, 
       gridLevels,
       nAsh, 
       repeat, 
-      seed;
+      seed,
+      serveCache,
+      serveJobs,
+      sourceJobs;
   bool ashOutput,
        averageOutput,
+       compactWinds,
 			 computeConcentration,
+       fallTable,
        gridOutput,
 			 needTemperatureData,
        newline, 
@@ -97,19 +115,25 @@ struct Argument {
        shiftWest, 
        showVolcs, 
        silent, 
+       stitchCycles,
        verbose;
+  GridKernel  gridKernel ;
+  Integrator  integrator ;
   Sedimentation  sedimentation ;
+  TimeSlab  timeSlab ;
   std::vector<std::string> planesFile;
   };
 
 void parse_options(int argc, char **argv);
+int set_option(const char *name, const char *value);
+int lookup_option(const char *name, std::string &longName);
 
 /* get the version number via autoconf and config.h */
 static const char puff_version_number[] = VERSION;
 
-enum keyWords {ASHOUTPUT, ARGFILE, ASHLOGMEAN, ASHLOGSDEV, AVERAGEOUTPUT, DEM, DIFFUSEH, DIFFUSEZ,
-DRAG, DTMINS, ERUPTDATE, ERUPTHOURS, ERUPTMASS, ERUPTVOLUME, FILEALL, FILET, FILEU, FILEV, FILEZ, GRIDBOX, GRIDLEVELS, GRIDOUTPUT, GRIDSIZE, HELP, LATLON, LOGFILE, LONLAT,
-MODEL, NASH, NEEDTEMPERATUREDATA, NEWLINE, NMC, NOFALLOUT, NOPATCH, OPATH, PARTICLEOUTPUT, PATH, PICKGRID, PHIDIST, PLANESFILE, PLUMEMAX, PLUMEMIN, PLUMEHWIDTH, PLUMEZWIDTH, PLUMESHAPE, QUIET, RCFILE, REGIONALWINDS, REPEAT, RESTARTFILE, RUNHOURS, RUNSURFACE, SAVEHOURS, SAVEASHINIT, SAVEWFILE, SEDIMENTATION, SEED, SHIFTWEST, SHOWVOLCS, SILENT, SORTED, VARU, VARV, VARZ, VERBOSE, PUFF_VERSION, VOLC, VOLCLAT, VOLCLON, VOLCFILE };
+enum keyWords {ADAPTIVE, ASHOUTPUT, ARGFILE, ASHLOGMEAN, ASHLOGSDEV, AVERAGEOUTPUT, BENCHMARK, CFL, CHECKPOINTFILE, CHECKPOINTHOURS, COMPACTWINDS, DEM, DIFFUSEH, DIFFUSEZ,
+DRAG, DTMINS, ERUPTDATE, ERUPTHOURS, ERUPTMASS, ERUPTVOLUME, FILEALL, FILET, FILEU, FILEV, FILEZ, GRIDBOX, GRIDKERNEL, GRIDLEVELS, GRIDOUTPUT, GRIDSIZE, HELP, INTEGRATOR, LATLON, LOGFILE, LONLAT,
+MODEL, NASH, NEEDTEMPERATUREDATA, NEST, NEWLINE, NMC, NOFALLOUT, NOPATCH, OPATH, PARTICLEOUTPUT, PATH, PICKGRID, PHIDIST, PLANESFILE, PLUMEMAX, PLUMEMIN, PLUMEHWIDTH, PLUMEZWIDTH, PLUMESHAPE, PROFILE, QUIET, RCFILE, REGIONALWINDS, REPEAT, RESTARTFILE, RESUME, RUNHOURS, RUNSURFACE, SAVEHOURS, SAVEASHINIT, SAVEWFILE, SEDIMENTATION, SEED, SERVE, SERVECACHE, SERVEJOBS, SHIFTWEST, SHOWVOLCS, SILENT, SORTED, SOURCEJOBS, SOURCES, STITCHCYCLES, TIMESLAB, VARU, VARV, VARZ, VERBOSE, PUFF_VERSION, VOLC, VOLCLAT, VOLCLON, VOLCFILE };
 
 void show_help();
 
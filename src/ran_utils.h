@@ -11,6 +11,18 @@ float gammln(float xx);
 float factorial(float f);
 float poi_dist(float xm, int &idum);
 
+// state kept between calls of ran1() and gasdev(), so that a checkpoint 
+// can continue the same sequence
+struct RanState {
+  long  ix1, ix2, ix3;
+  float r[98];
+  int   iff;
+  int   iset;
+  float gset;
+};
+void get_ran_state(RanState &state);
+void set_ran_state(const RanState &state);
+
 // RAN1 DEFS:
 #define M1 259200
 #define IA1 7141
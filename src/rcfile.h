@@ -3,6 +3,7 @@
 #define PUFF_MAX_NUM_MASKS 100
 #include <string>
 #include <cstring>
+#include <vector>
 
 class PuffRC {
   private:
@@ -28,6 +29,9 @@ class PuffRC {
     std::string getString(char *p);
     std::string getString(const std::string* p);
     const std::string mostRecentFile(const char *edate, char *var, double runHours = 0.0);
+    const std::vector<std::string> newerFiles(const std::string &file, char *var);
+    const std::string cycleFile(const std::string &file, char *fileVar, 
+                                char *var);
     };
     
 #endif
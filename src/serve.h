@@ -0,0 +1,67 @@
+/****************************************************************************
+    puff - a volcanic ash tracking model
+    Copyright (C) 2001-2003 Rorik Peterson <rorik@gi.alaska.edu>
+
+    This program is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program; if not, write to the Free Software
+    Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+****************************************************************************/
+
+#ifndef SERVE_H_
+#define SERVE_H_
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include <string>
+#include <vector>
+
+// puff -serve SOCKET keeps prepared atmospheres in memory and runs 
+// requests from a unix domain socket.  A client connects and sends one 
+// line holding the options of a run, as on the command line.  The reply is
+// the text output of the run, a "FILE path" line for each file written, 
+// and a last line of "STATUS OK" or "STATUS ERROR".
+//
+// Requests that load the same atmosphere share one resident process, which
+// loads it with its first request and forks a worker for each request.  
+// The atmosphere is named by a key: the atmosphere options (see 
+// isSharedOption()) with the eruption date as resolved, and the wind 
+// files those select, so a new model cycle gets a new process.  At most 
+// 'cacheSize' of these are kept, dropping the least recently used, and 
+// each runs at most 'jobs' workers at once.
+
+// a function run for a request, given its options.  Returns PUFF_OK or 
+// PUFF_ERROR.
+typedef int (*ServeFunction)(std::vector<std::string> &args);
+
+// a function giving the key of a request, or "" if it has none
+typedef std::string (*ServeKeyFunction)(std::vector<std::string> &args);
+
+// run the server until it fails.  'key' names the atmosphere of a request,
+// 'load' prepares it, and 'run' runs a request against it.
+int serve(const char *socketPath, int cacheSize, int jobs, 
+          ServeKeyFunction key, ServeFunction load, ServeFunction run);
+
+// split a request line into words, removing quotes
+bool splitRequest(const std::string &line, std::vector<std::string> &args);
+
+// the options of a request that select its atmosphere, with 'eruptDate' 
+// in place of its -eruptDate if given
+std::string serveKey(const std::vector<std::string> &args, 
+                     const char *eruptDate = 0);
+
+// report an output file to the client, if this is a request
+void serveReportFile(const std::string &file);
+
+#endif
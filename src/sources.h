@@ -0,0 +1,49 @@
+/****************************************************************************
+    puff - a volcanic ash tracking model
+    Copyright (C) 2001-2003 Rorik Peterson <rorik@gi.alaska.edu>
+
+    This program is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program; if not, write to the Free Software
+    Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+****************************************************************************/
+
+#ifndef SOURCES_H_
+#define SOURCES_H_
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include <string>
+#include <vector>
+#include <utility>
+
+// one eruption source of a multi-source run (-sources).  A source is a 
+// volcano name or a lon/lat location, and any options that differ from 
+// the command line for this source.
+struct Source {
+  std::string name;     // volcano name, or 'name=' for a lon/lat source
+  bool        hasLonLat;
+  double      lon, lat;
+  std::vector<std::pair<std::string, std::string> > options;
+  };
+
+// read a sources file.  Returns the number of sources, or -1 on error.
+int readSources(const char *filename, std::vector<Source> &sources);
+
+// options that select or change the wind data, or apply to the whole run,
+// and cannot differ between sources sharing one atmosphere.  -serve uses
+// the same list to decide which requests can share an atmosphere.
+bool isSharedOption(const std::string &name);
+
+#endif
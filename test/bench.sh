@@ -0,0 +1,27 @@
+#!/bin/sh
+# performance benchmark using synthetic wind fields.  This is not part of
+# 'make check'; run it with 'make bench'.  Wind files are generated locally
+# with synthwinds.pl and ncgen so no downloaded data is needed.  Each run
+# writes stage timings, particle-steps per second and peak memory use as
+# JSON to bench_<type>.json
+#
+# environment variables, and those of bench_common.sh:
+#   PUFF_BENCH_NASH   number of ash particles (default 100000)
+#   PUFF_BENCH_TYPES  wind fields to run (default "rotation shear")
+bench_name=bench
+srcdir=`dirname $0`
+PUFF_BENCH_NASH=${PUFF_BENCH_NASH:-100000}
+. $srcdir/bench_common.sh
+types=${PUFF_BENCH_TYPES:-"rotation shear"}
+
+for type in $types; do
+  bench_winds bench_$type -type $type -hours $hours
+done
+
+for type in $types; do
+  bench_run "$type benchmark with $nash particles" bench_$type -model bench_$type -runHours $hours -saveHours 6 -nAsh $nash -gridOutput=true -benchmark bench_$type.json
+  cat bench_$type.json
+done
+
+rm -f $error_file
+exit 0
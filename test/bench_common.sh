@@ -0,0 +1,107 @@
+# setup shared by the scripts that run puff on synthetic winds.  Source it
+# after setting bench_name; it sets error_file, bench_dir and puffrc, and
+# stops the script, as a skipped test, when ncgen or puff is not available.
+#
+# environment variables:
+#   PUFF_BENCH_NASH   number of ash particles (default 10000)
+#   PUFF_BENCH_HOURS  simulation length in hours (default 24)
+error_file="$bench_name.err"
+PUFF_VOLCANO_LIST="../etc/volcanos.txt"
+export PUFF_VOLCANO_LIST
+
+thisdir=`pwd`
+bench_dir=$thisdir/bench_data
+puffrc=$bench_dir/puffrc_$bench_name
+nash=${PUFF_BENCH_NASH:-10000}
+hours=${PUFF_BENCH_HOURS:-24}
+bench_puff=../src/puff
+bench_ncgen=ncgen
+
+if (which ncgen > /dev/null 2>&1); then
+  :
+else
+  echo "you need 'ncgen' from the netCDF distribution to run $bench_name"
+  exit 0
+fi
+if test -x ../src/puff && test -x ../src/ashdump; then
+  :
+else
+  echo "you need to build ../src/puff and ../src/ashdump to run $bench_name"
+  exit 0
+fi
+
+if (test -d $bench_dir); then
+  :
+else
+  mkdir -m 755 $bench_dir
+fi
+rm -f $puffrc $error_file
+
+# bench_winds <model> <synthwinds.pl options>: write the winds of <model>
+# to 2006072500_<model>.nc in bench_dir, unless a file from the same
+# options is already there, and add the model to puffrc
+bench_winds() {
+  model=$1
+  shift
+  wind_file=$bench_dir/2006072500_$model.nc
+  if test -r $wind_file && test "`cat $wind_file.options 2>/dev/null`" = "$*"
+  then
+    :
+  else
+    echo "generating $model winds"
+    rm -f $wind_file.options
+    perl $srcdir/synthwinds.pl "$@" | $bench_ncgen -o $wind_file
+    if test $? -ne 0; then
+      echo "failed to generate $wind_file"
+      exit 1
+    fi
+    echo "$*" > $wind_file.options
+  fi
+  echo "model=$model mask=YYYYMMDDHH_$model.nc var=u,v path=$bench_dir" >> $puffrc
+}
+
+# bench_run <what> <dir> <puff options>: run bench_puff from the test
+# eruption, saving the ash in <dir> of bench_dir after removing the ash
+# files of an earlier run
+bench_run() {
+  what=$1
+  run_dir=$bench_dir/$2
+  shift 2
+  mkdir -p $run_dir
+  rm -f $run_dir/*_ash.cdf
+  echo "running $what"
+  $bench_puff -lonLat 200/55 -eruptDate "2006 07 25 00:00" -seed 1 -quiet -rcfile $puffrc -opath $run_dir/ "$@" > /dev/null 2>>$error_file
+  if test $? -ne 0; then
+    echo "puff failed $what, see $error_file"
+    exit 1
+  fi
+}
+
+# bench_dump <dir> <variables>: write the comma separated particle
+# <variables> of the last ash file in <dir> to <dir>.txt, one line each
+bench_dump() {
+  ash_file=`ls $bench_dir/$1/*_ash.cdf | tail -1`
+  nvars=`echo $2 | awk -F, '{ print NF }'`
+  ../src/ashdump -variables=$2 $ash_file 2>>$error_file | \
+    awk -v n=$nvars 'NF == n && $1 == $1+0' > $bench_dir/$1.txt
+}
+
+# bench_compare <dir1> <dir2> [tolerance]: print the differences between
+# the lon,lat[,height] dumps of two runs, in degrees horizontally and
+# meters vertically.  Fails if there is nothing to compare or a horizontal
+# difference is above the tolerance in degrees
+bench_compare() {
+  paste $bench_dir/$1.txt $bench_dir/$2.txt | awk -v tol="$3" '
+    NF == 4 || NF == 6 { n++; m = NF/2;
+      dx = $(m+1) - $1; dy = $(m+2) - $2;
+      if (dx > 180) dx -= 360; if (dx < -180) dx += 360;
+      h = sqrt(dx*dx + dy*dy); if (h > hmax) hmax = h; hsum += h*h;
+      if (m == 3) { z = 1; dz = $6 - $3;
+        if (dz < 0) dz = -dz; if (dz > zmax) zmax = dz; zsum += dz*dz; } }
+    END { if (n == 0) { print "no particles to compare"; exit 1 }
+      printf("%d particles\n", n);
+      printf("horizontal difference (deg): rms %g max %g\n", sqrt(hsum/n), hmax);
+      if (z) printf("vertical difference (m):     rms %g max %g\n", sqrt(zsum/n), zmax);
+      if (tol != "" && hmax > tol+0) {
+        printf("FAILED: difference above %g degrees\n", tol); exit 1 } }'
+}
@@ -0,0 +1,41 @@
+#!/bin/sh
+# check that a run resumed from a checkpoint ends exactly where the
+# uninterrupted run does.  A run on synthetic winds writes a checkpoint 
+# half way through, then a second run resumes from it, and the final 
+# particle locations of both are compared.  'make check' runs it with
+# fewer particles and hours.
+#
+# environment variables: those of bench_common.sh
+bench_name=checkpoint
+srcdir=`dirname $0`
+. $srcdir/bench_common.sh
+half=`expr $hours / 2`
+
+bench_winds bench_rotation -type rotation -hours $hours
+
+options="-model bench_rotation -runHours $hours -saveHours $hours -nAsh $nash"
+rm -f $bench_dir/puff.ckpt
+bench_run "with a checkpoint at $half hours" full $options -checkpointHours $half -checkpointFile $bench_dir/puff.ckpt
+if test ! -r $bench_dir/puff.ckpt; then
+  echo "checkpointed run wrote no checkpoint, see $error_file"
+  exit 1
+fi
+bench_run "from the checkpoint" resumed $options -resume $bench_dir/puff.ckpt
+
+for run in full resumed; do
+  bench_dump $run lon,lat,height
+done
+if test ! -s $bench_dir/full.txt; then
+  echo "no particles to compare"
+  exit 1
+fi
+if cmp -s $bench_dir/full.txt $bench_dir/resumed.txt; then
+  echo "resumed run matches the full run"
+  status=0
+else
+  echo "resumed run differs from the full run"
+  status=1
+fi
+
+rm -f $error_file $bench_dir/puff.ckpt
+exit $status
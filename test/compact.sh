@@ -0,0 +1,32 @@
+#!/bin/sh
+# run puff with the winds stored as floats and with -compactWinds, on the
+# same synthetic shear winds with the same seed, and compare the final
+# particle locations.  The compact winds are within 1/65534 of each
+# level's range, so the particles should stay close.  'make check' runs
+# it with fewer particles and hours.
+#
+# environment variables, and those of bench_common.sh:
+#   PUFF_COMPACT_TOL  largest allowed horizontal difference in degrees 
+#                     (default 0.01)
+bench_name=compact
+srcdir=`dirname $0`
+. $srcdir/bench_common.sh
+tol=${PUFF_COMPACT_TOL:-0.01}
+
+bench_winds bench_shear -type shear -hours $hours
+
+for store in float compact; do
+  if test $store = compact; then
+    flag=-compactWinds
+  else
+    flag=
+  fi
+  bench_run "with $store winds" $store -model bench_shear -runHours $hours -saveHours $hours -nAsh $nash $flag
+  bench_dump $store lon,lat,height
+done
+
+bench_compare float compact $tol
+status=$?
+
+rm -f $error_file
+exit $status
@@ -0,0 +1,44 @@
+#!/bin/sh
+# run puff on the GRIB2 wind files in grib2/ and compare the final particle
+# locations against a run on the same winds in netCDF.  The GRIB2 files were
+# written with
+#   perl synthwinds.pl -res 15 -hours 12 -grib2 simple
+#   perl synthwinds.pl -res 15 -hours 12 -grib2 complex
+# and hold the winds to 0.01 m/s, so the runs should agree closely.  It is
+# part of 'make check'; grib2check reads a file that synthwinds.pl did not
+# write.
+#
+# environment variables, and those of bench_common.sh:
+#   PUFF_GRIB2_TOL    largest allowed difference in degrees (default 0.01)
+#   PUFF_BENCH_NASH   number of ash particles (default 1000)
+bench_name=grib2
+srcdir=`dirname $0`
+PUFF_BENCH_NASH=${PUFF_BENCH_NASH:-1000}
+. $srcdir/bench_common.sh
+tol=${PUFF_GRIB2_TOL:-0.01}
+hours=12
+
+# the files are given on the command line, the model only names the variables
+bench_winds grib2 -res 15 -hours $hours
+
+for run in netcdf simple complex; do
+  if test $run = netcdf; then
+    file=$bench_dir/2006072500_grib2.nc
+  else
+    file=$srcdir/grib2/2006072500_$run.grb2
+  fi
+  bench_run "on $file" grib2_$run -model grib2 -fileU $file -fileV $file -runHours $hours -saveHours $hours -nAsh $nash
+  bench_dump grib2_$run lon,lat
+done
+
+status=0
+for run in simple complex; do
+  echo "$run packing:"
+  bench_compare grib2_netcdf grib2_$run $tol
+  if test $? -ne 0; then
+    status=1
+  fi
+done
+
+rm -f $error_file
+exit $status
@@ -0,0 +1,35 @@
+#!/bin/sh
+# run puff on a fine synthetic wind grid and compare the final particle
+# locations against a run on the default coarse grid.  The rotation winds
+# are analytic, so both runs should follow the same trajectories; an
+# indexing overflow in the grid code shows up as particles that are far
+# apart.  Grids with more than 2^32 values need a lot of memory (the U
+# and V files alone are 4 bytes per value each) so the default resolution
+# is modest; set PUFF_LARGE_RES to 0.04 with PUFF_BENCH_HOURS=30 to cross
+# that size.  This is not part of 'make check'; gridcheck checks the
+# sizes and offsets past 2^32 values there without allocating the grid.
+#
+# environment variables, and those of bench_common.sh:
+#   PUFF_LARGE_RES    fine grid spacing in degrees (default 0.25)
+#   PUFF_LARGE_TOL    largest allowed difference in degrees (default 0.5)
+bench_name=largegrid
+srcdir=`dirname $0`
+. $srcdir/bench_common.sh
+res=${PUFF_LARGE_RES:-0.25}
+tol=${PUFF_LARGE_TOL:-0.5}
+bench_ncgen="ncgen -k 2"
+
+# no bad values, patching would smooth the two grids differently
+bench_winds large_coarse -type rotation -res 2.5 -bad 0 -hours $hours
+bench_winds large_fine -type rotation -res $res -bad 0 -hours $hours
+
+for grid in coarse fine; do
+  bench_run "on the $grid grid" large_$grid -model large_$grid -runHours $hours -saveHours $hours -nAsh $nash -noPatch
+  bench_dump large_$grid lon,lat
+done
+
+bench_compare large_coarse large_fine $tol
+status=$?
+
+rm -f $error_file
+exit $status
@@ -0,0 +1,34 @@
+#!/bin/sh
+# compare single and double precision particle builds.  Configure and 
+# build puff twice, once --with-single-precision, and point this script at
+# both binaries.  Both are run on the same synthetic winds with the same
+# seed, and the final particle locations are compared.  This is not part
+# of 'make check'.
+#
+# environment variables, and those of bench_common.sh:
+#   PUFF_DOUBLE       double precision puff binary (required)
+#   PUFF_SINGLE       single precision puff binary (default ../src/puff)
+bench_name=precision
+srcdir=`dirname $0`
+single=${PUFF_SINGLE:-../src/puff}
+double=$PUFF_DOUBLE
+
+if test -z "$double"; then
+  echo "set PUFF_DOUBLE to a puff binary built without --with-single-precision"
+  exit 1
+fi
+. $srcdir/bench_common.sh
+
+bench_winds bench_rotation -type rotation -hours $hours
+
+for prec in double single; do
+  eval bench_puff=\$$prec
+  bench_run "with $prec precision" $prec -model bench_rotation -runHours $hours -saveHours $hours -nAsh $nash
+  bench_dump $prec lon,lat,height
+done
+
+bench_compare double single
+status=$?
+
+rm -f $error_file
+exit $status
@@ -0,0 +1,60 @@
+#!/bin/sh
+# run puff on synthetic shear winds, saving the ash every hour, and
+# summarize the saved files with 'ashdump -series'.  The table from 
+# several workers (-jobs) must be identical to the one from a single 
+# process and have one line per file, and the mean location of each line
+# must agree with 'ashdump -stats' on that file.  'make check' runs it
+# with fewer particles and hours.
+#
+# environment variables, and those of bench_common.sh:
+#   PUFF_SERIES_JOBS  number of ashdump workers (default 4)
+bench_name=series
+srcdir=`dirname $0`
+. $srcdir/bench_common.sh
+jobs=${PUFF_SERIES_JOBS:-4}
+
+bench_winds bench_shear -type shear -hours $hours
+
+bench_run "puff, saving every hour" series -model bench_shear -runHours $hours -saveHours 1 -nAsh $nash
+
+files=`ls $bench_dir/series/*_ash.cdf`
+nfiles=`echo $files | wc -w`
+../src/ashdump -series $files > $bench_dir/series_1.txt 2>>$error_file
+if test $? -ne 0; then
+  echo "ashdump -series failed, see $error_file"
+  exit 1
+fi
+../src/ashdump -series -jobs=$jobs $files > $bench_dir/series_$jobs.txt 2>>$error_file
+if test $? -ne 0; then
+  echo "ashdump -series -jobs=$jobs failed, see $error_file"
+  exit 1
+fi
+
+if cmp -s $bench_dir/series_1.txt $bench_dir/series_$jobs.txt; then
+  :
+else
+  echo "FAILED: the table from $jobs workers differs from one process"
+  exit 1
+fi
+
+nrows=`awk 'NR > 1' $bench_dir/series_1.txt | wc -l`
+if test $nrows -ne $nfiles; then
+  echo "FAILED: $nrows lines for $nfiles files"
+  exit 1
+fi
+
+# the geometric center from -stats on the last file
+last=`echo $files | awk '{print $NF}'`
+../src/ashdump -stats $last 2>>$error_file | \
+  awk '/Geometric Center/ { getline; gsub(/[(),]/, " "); print $1, $2 }' > $bench_dir/series_stats.txt
+tail -1 $bench_dir/series_1.txt | awk '{ print $5, $6 }' | \
+  paste - $bench_dir/series_stats.txt | awk '
+  NF == 4 { dx = $1 - $3; dy = $2 - $4; if (dx < 0) dx = -dx; if (dy < 0) dy = -dy;
+    printf("last file: series center %s %s, stats center %s %s\n", $1, $2, $3, $4);
+    if (dx > 0.01 || dy > 0.01) { print "FAILED: the centers differ"; exit 1 }
+    ok = 1 }
+  END { if (!ok) { print "no statistics to compare"; exit 1 } }'
+status=$?
+
+rm -f $error_file
+exit $status
@@ -0,0 +1,286 @@
+#!/usr/bin/perl -w
+#
+# write a CDL description of a synthetic, global wind field to stdout.  Pipe
+# the output through 'ncgen' to create a netCDF file that puff can read, e.g.
+#
+#   perl synthwinds.pl -type rotation | ncgen -o 2006072500_bench.nc
+#
+# With -grib2 the same fields are written as GRIB2 messages instead, which
+# puff reads directly:
+#
+#   perl synthwinds.pl -grib2 complex > 2006072500_bench.grb2
+#
+# The fields are analytic so the expected trajectories and vertical wind
+# are known:
+#   rotation   solid-body rotation about the pole, u = U0 cos(lat), v = 0
+#   shear      u = U0 cos(lat) increasing linearly with height, v = 0
+# Both are non-divergent, so the W that puff derives should be zero.
+#
+# OPTIONS:
+#   -type rotation|shear   wind field (default rotation)
+#   -res  degrees          horizontal grid spacing (default 2.5)
+#   -date YYYYMMDDHH       reference time (default 2006072500)
+#   -hours N               forecast length in hours, 6-hourly (default 24)
+#   -bad  percent          percent of u values set to _FillValue so that
+#                          patching is exercised (default 1)
+#   -speed U0              wind speed in m/s (default 20)
+#   -grib2 simple|complex  write GRIB2 with simple packing and a bitmap, or
+#                          with complex packing and second order spatial
+#                          differencing, values to 0.01 m/s
+
+use strict;
+
+my $type = "rotation";
+my $res = 2.5;
+my $date = "2006072500";
+my $hours = 24;
+my $bad = 1;
+my $speed = 20;
+my $grib2 = "";
+
+while (my $arg = shift @ARGV)
+{
+  if    ($arg eq "-type")  { $type = shift @ARGV; }
+  elsif ($arg eq "-res")   { $res = shift @ARGV; }
+  elsif ($arg eq "-date")  { $date = shift @ARGV; }
+  elsif ($arg eq "-hours") { $hours = shift @ARGV; }
+  elsif ($arg eq "-bad")   { $bad = shift @ARGV; }
+  elsif ($arg eq "-speed") { $speed = shift @ARGV; }
+  elsif ($arg eq "-grib2") { $grib2 = shift @ARGV; }
+  else { die "unknown option $arg\n"; }
+}
+die "unknown wind type \"$type\"\n" unless ($type eq "rotation" or $type eq "shear");
+die "unknown GRIB2 packing \"$grib2\"\n" unless ($grib2 eq "" or $grib2 eq "simple" or $grib2 eq "complex");
+die "date must be YYYYMMDDHH\n" unless ($date =~ /^(\d{4})(\d\d)(\d\d)(\d\d)$/);
+my $units_date = "$1-$2-$3 $4:00:00";
+
+my $pi = 4*atan2(1,1);
+my $fill = -9999.0;
+my @level = (1000, 925, 850, 700, 600, 500, 400, 300, 250, 200, 150, 100, 70, 50, 30, 20, 10);
+my $nlon = int(360/$res + 0.5);
+my $nlat = int(180/$res + 0.5) + 1;
+my $ntime = int($hours/6) + 1;
+my @lat = map { 90 - $_*$res } (0..$nlat-1);
+
+# a fixed seed so every benchmark run reads the same bad values
+srand(1);
+
+my (@u, @v);
+for (my $t = 0; $t < $ntime; $t++) {
+  foreach my $p (@level) {
+    # shear increases from zero at the surface to U0 near the tropopause
+    my $scale = ($type eq "shear") ? (1000 - $p)/800 : 1;
+    foreach my $y (@lat) {
+      my $val = sprintf("%.3f", $speed*$scale*cos($y*$pi/180));
+      for (my $i = 0; $i < $nlon; $i++) {
+        push @u, (rand(100) < $bad) ? $fill : $val;
+        push @v, 0;
+      }
+    }
+  }
+}
+if ($grib2) {
+  write_grib2();
+  exit 0;
+}
+
+print "netcdf synthwinds {\n";
+print "dimensions:\n";
+print "\tlon = $nlon ;\n\tlat = $nlat ;\n\tlevel = ", scalar(@level), " ;\n";
+print "\ttime = UNLIMITED ;\n";
+print "variables:\n";
+print "\tfloat lon(lon) ;\n\t\tlon:units = \"degrees_east\" ;\n";
+print "\tfloat lat(lat) ;\n\t\tlat:units = \"degrees_north\" ;\n";
+print "\tfloat level(level) ;\n\t\tlevel:units = \"millibar\" ;\n";
+print "\tdouble time(time) ;\n\t\ttime:units = \"hours since $units_date\" ;\n";
+foreach my $var ("u", "v")
+{
+  print "\tfloat $var(time, level, lat, lon) ;\n";
+  print "\t\t$var:units = \"m/s\" ;\n";
+  print "\t\t$var:_FillValue = ${fill}f ;\n";
+}
+print "\n// global attributes:\n";
+print "\t\t:title = \"synthetic $type winds for puff benchmarks\" ;\n";
+print "data:\n";
+
+print "\n lon = ", join(", ", map { $_*$res } (0..$nlon-1)), " ;\n";
+print "\n lat = ", join(", ", @lat), " ;\n";
+print "\n level = ", join(", ", @level), " ;\n";
+print "\n time = ", join(", ", map { 6*$_ } (0..$ntime-1)), " ;\n";
+
+print "\n u = ", join(", ", @u), " ;\n";
+print "\n v = ", join(", ", @v), " ;\n";
+print "}\n";
+
+#############################################################################
+# GRIB2 output, one message per variable, time and level
+#############################################################################
+
+# sign and magnitude integers of 'n' octets
+sub sm {
+  my ($v, $n) = @_;
+  my $m = abs($v);
+  $m += 2**(8*$n - 1) if ($v < 0);
+  return $n == 1 ? pack("C", $m) : $n == 2 ? pack("n", $m) : pack("N", $m);
+}
+
+# number of bits to hold values up to 'v'
+sub nbits {
+  my $v = shift;
+  my $n = 0;
+  while ($v >= 2**$n) { $n++; }
+  return $n;
+}
+
+sub section {
+  my ($num, $body) = @_;
+  return pack("NC", length($body) + 5, $num) . $body;
+}
+
+# packed bits from a list of [value, width] pairs, padded to an octet
+sub bits {
+  my $b = join("", map { $_->[1] ? substr(unpack("B32", pack("N", $_->[0])), 32 - $_->[1]) : "" } @_);
+  $b .= "0" x ((8 - length($b) % 8) % 8);
+  return pack("B*", $b);
+}
+
+# data representation and data sections for values scaled by 10^2 with
+# undef for missing points
+sub simple_packing {
+  my @x = @_;
+  my @ok = grep { defined } @x;
+  my $min = 0;
+  my $max = 0;
+  if (@ok) {
+    $min = $max = $ok[0];
+    foreach (@ok) { $min = $_ if ($_ < $min); $max = $_ if ($_ > $max); }
+  }
+  my $nb = nbits($max - $min);
+  # 5.0: R (float), E, D, bits per value, original type
+  my $s5 = section(5, pack("Nn", scalar(@ok), 0) . pack("f>", $min)
+                   . sm(0, 2) . sm(2, 2) . pack("CC", $nb, 0));
+  my $s6 = section(6, pack("C", 0)
+                   . bits(map { [defined($_) ? 1 : 0, 1] } @x));
+  my $s7 = section(7, bits(map { [$_ - $min, $nb] } @ok));
+  return $s5 . $s6 . $s7;
+}
+
+sub complex_packing {
+  my @x = @_;
+  # second order differences of the values that are not missing, the first
+  # two are carried in the extra descriptors
+  my @ok = grep { defined } @x;
+  my @d;
+  for (my $k = 2; $k < @ok; $k++) {
+    push @d, $ok[$k] - 2*$ok[$k-1] + $ok[$k-2];
+  }
+  my $minsd = @d ? $d[0] : 0;
+  foreach (@d) { $minsd = $_ if ($_ < $minsd); }
+  my @s = ((0) x (@ok < 2 ? @ok : 2), map { $_ - $minsd } @d);
+  my $n = 0;
+  my @packed = map { defined($_) ? $s[$n++] : undef } @x;
+  my $extra = 1;
+  foreach ($ok[0] || 0, $ok[1] || 0, $minsd) {
+    $extra++ while (abs($_) >= 2**(8*$extra - 1));
+  }
+
+  # groups of 8 and 12 values in turn; the all ones value of each width
+  # marks the missing points (missing value management 1)
+  my (@ref, @width, @length);
+  for (my $i = 0, my $g = 0; $i < @packed; $g++) {
+    my $len = ($g % 2) ? 12 : 8;
+    $len = @packed - $i if ($i + $len > @packed);
+    my @grp = @packed[$i .. $i + $len - 1];
+    my @val = grep { defined } @grp;
+    my $missing = (@val < @grp);
+    my ($lo, $hi);
+    foreach (@val) {
+      $lo = $_ if (!defined($lo) or $_ < $lo);
+      $hi = $_ if (!defined($hi) or $_ > $hi);
+    }
+    if (!@val) {
+      push @ref, undef;
+      push @width, 0;
+    } elsif ($hi == $lo && !$missing) {
+      push @ref, $lo;
+      push @width, 0;
+    } else {
+      push @ref, $lo;
+      push @width, nbits($hi - $lo + 1);
+    }
+    push @length, $len;
+    $i += $len;
+  }
+  my $maxref = 0;
+  foreach (@ref) { $maxref = $_ if (defined($_) && $_ > $maxref); }
+  my $nb = nbits($maxref + 1);
+  my $refmiss = 2**$nb - 1;
+  my ($wlo, $whi) = ($width[0], $width[0]);
+  foreach (@width) { $wlo = $_ if ($_ < $wlo); $whi = $_ if ($_ > $whi); }
+  my $wbits = nbits($whi - $wlo);
+
+  my @values;
+  for (my $i = 0, my $g = 0; $g < @ref; $g++) {
+    for (my $j = 0; $j < $length[$g]; $j++, $i++) {
+      next if ($width[$g] == 0);
+      my $v = defined($packed[$i]) ? $packed[$i] - $ref[$g] : 2**$width[$g] - 1;
+      push @values, [$v, $width[$g]];
+    }
+  }
+  my $data = bits(map { [$_, 8*$extra] } map { $_ < 0 ? abs($_) + 2**(8*$extra - 1) : $_ }
+                  ((@ok > 0 ? $ok[0] : 0), (@ok > 1 ? $ok[1] : 0), $minsd))
+           . bits(map { [defined($_) ? $_ : $refmiss, $nb] } @ref)
+           . bits(map { [$_ - $wlo, $wbits] } @width)
+           . bits(map { [($_ == 8 ? 0 : 1), 1] } @length)
+           . bits(@values);
+
+  # 5.3: R, E, D, bits for group references, original type, group
+  # splitting, missing value management, missing value substitutes, groups,
+  # width reference and bits, length reference, increment, last length and
+  # bits, order of differencing and octets of the extra descriptors
+  my $s5 = section(5, pack("Nn", scalar(@x), 3) . pack("f>", 0)
+                   . sm(0, 2) . sm(2, 2) . pack("CCCC", $nb, 0, 1, 1)
+                   . pack("f>f>", $fill, $fill) . pack("NCC", scalar(@ref), $wlo, $wbits)
+                   . pack("NCNC", 8, 4, $length[-1], 1) . pack("CC", 2, $extra));
+  my $s6 = section(6, pack("C", 255));
+  my $s7 = section(7, $data);
+  return $s5 . $s6 . $s7;
+}
+
+sub write_grib2 {
+  $date =~ /^(\d{4})(\d\d)(\d\d)(\d\d)$/;
+  my ($yr, $mo, $dy, $hr) = ($1, $2, $3, $4);
+  my $npoints = $nlon*$nlat;
+  # identification: centre, sub-centre, table versions, significance of the
+  # reference time, reference time, production status, type of data
+  my $s1 = section(1, pack("nnCCC", 7, 0, 2, 0, 1) . pack("nCCCCC", $yr, $mo, $dy, $hr, 0, 0)
+                   . pack("CC", 0, 1));
+  # 3.0: regular lat/lon grid on a spherical earth, scanning north to south
+  my $s3 = section(3, pack("CNCCn", 0, $npoints, 0, 0, 0)
+                   . pack("CCNCNCN", 6, 0, 0, 0, 0, 0, 0)
+                   . pack("NNNN", $nlon, $nlat, 0, 0)
+                   . sm(90e6, 4) . sm(0, 4) . pack("C", 0x30)
+                   . sm(int($lat[-1]*1e6), 4) . sm(int(($nlon-1)*$res*1e6 + 0.5), 4)
+                   . pack("NNC", int($res*1e6 + 0.5), int($res*1e6 + 0.5), 0));
+  my %param = ("u" => 2, "v" => 3);
+  my %values = ("u" => \@u, "v" => \@v);
+  binmode STDOUT;
+  foreach my $var ("u", "v") {
+    my $n = 0;
+    for (my $t = 0; $t < $ntime; $t++) {
+      foreach my $p (@level) {
+        my @x = map { $_ == $fill ? undef : int($_*100 + ($_ < 0 ? -0.5 : 0.5)) }
+                @{$values{$var}}[$n .. $n + $npoints - 1];
+        $n += $npoints;
+        # 4.0: momentum category, forecast hours, isobaric surface in Pa
+        my $s4 = section(4, pack("nnCC", 0, 0, 2, $param{$var})
+                         . pack("CCCnCC", 2, 0, 0, 0, 0, 1) . pack("N", 6*$t)
+                         . pack("CCN", 100, 0, 100*$p) . pack("CCN", 255, 0, 0));
+        my $body = $s1 . $s3 . $s4
+                   . ($grib2 eq "simple" ? simple_packing(@x) : complex_packing(@x))
+                   . "7777";
+        print "GRIB", pack("nCC", 0, 0, 2), pack("NN", 0, length($body) + 16), $body;
+      }
+    }
+  }
+}
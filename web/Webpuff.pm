@@ -36,6 +36,9 @@ $home_abs="$home/web";
 
 $pidfile="$home_exe/etc/webpuff.pid";
 $puff_exe="$home_exe/bin/puff ";
+# if puff runs as a server ("puff -serve SOCKET"), name its socket here and
+# runs are sent to it rather than starting a new puff for each one
+$puff_socket="";
 $ashxp_exe="$home_exe/bin/ashxp ";
 $ashgmt_exe="$home_exe/bin/ashgmt --verbose --movie=movie.gif ";
 
@@ -3,6 +3,7 @@
 use CGI qw(:all);
 use Webpuff;
 use File::Basename;
+use IO::Socket::UNIX;
 use strict;
 
 my $q = new CGI;
@@ -395,8 +396,16 @@ sub process_form {
   open LOG, ">>$Webpuff::home_abs/$oPath/puff.log";
   print LOG "$command\n";
   my $err = "";
-  open PUFF, "$command 2>&1|";
-  while (<PUFF>) {
+  my $puff;
+  if ($Webpuff::puff_socket and -S $Webpuff::puff_socket) {
+    # a resident puff server runs the same options without reloading winds
+    my $request = $command;
+    $request =~ s/^\Q$Webpuff::puff_exe\E//;
+    $puff = IO::Socket::UNIX->new(Peer => $Webpuff::puff_socket);
+    print $puff "$request\n" if ($puff);
+  }
+  open $puff, "$command 2>&1|" unless ($puff);
+  while (<$puff>) {
     my $text_color = "black";
     # log everything
     print LOG $_;
@@ -406,8 +415,9 @@ sub process_form {
 		# $_ =~ s/Reading.*/Reading data/;
     print STDOUT "<FONT size = 1 color=$text_color>$_</FONT><br/>";
     $err = $1 if ($_ =~ m/ERROR:(.*)/);
+    $err = "run failed" if ($_ =~ m/^STATUS ERROR/ and !$err);
   }
-  close PUFF;
+  close $puff;
   close LOG;
 
 